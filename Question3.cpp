@@ -8,6 +8,13 @@
 #include <cassert>
 #include <cctype>
 #include <algorithm>
+#include <queue>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <dirent.h>
+#include <sys/stat.h>
 
 class Publication {
 public:
@@ -25,6 +32,7 @@ class BibFileParser {
 private:
     std::vector<Publication> publications;
     std::map<std::string, std::vector<Publication>> authorPublicationMap;
+    size_t duplicatePublications;
 
     // Helper function to check if a string is numeric
     bool isNumeric(const std::string &str) {
@@ -77,9 +85,6 @@ private:
             } else {
                 authorsSet.insert(normalizeAuthorName(author));
             }
-
-            // Debugging: Print authors to ensure they are stored correctly
-            std::cout << "Normalized author: " << author << std::endl;
         }
     }
 
@@ -136,11 +141,33 @@ private:
         return Publication(title, venue, authors, year, doi);
     }
 
-public:
-    void parse(const std::string &filename) {
+    // Normalized "title|year" used to detect the same publication in more than one file.
+    // Braces and extra whitespace are dropped and the title is lowercased.
+    static std::string publicationKey(const Publication &pub) {
+        std::string key;
+        for (char c : pub.title) {
+            if (c == '{' || c == '}') {
+                continue;
+            }
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                if (!key.empty() && key[key.size() - 1] != ' ') {
+                    key += ' ';
+                }
+                continue;
+            }
+            key += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        if (!key.empty() && key[key.size() - 1] == ' ') {
+            key.erase(key.size() - 1);
+        }
+        return key + "|" + std::to_string(pub.year);
+    }
+
+    // Parse a single bib file into its own partial author index
+    void parseFileInto(const std::string &filename, std::map<std::string, std::vector<Publication>> &index) {
         std::ifstream file(filename);
         if (!file.is_open()) {
-            throw std::runtime_error("Could not open bib file");
+            throw std::runtime_error("Could not open bib file: " + filename);
         }
 
         std::string line, entry;
@@ -149,10 +176,9 @@ public:
                 if (!entry.empty()) {
                     validateEntry(entry);
                     Publication pub = parseEntry(entry);
-                    publications.push_back(pub);
 
                     for (const auto &author : pub.authors) {
-                        authorPublicationMap[author].push_back(pub);
+                        index[author].push_back(pub);
                     }
 
                     entry.clear();
@@ -163,15 +189,155 @@ public:
         if (!entry.empty()) {
             validateEntry(entry);
             Publication pub = parseEntry(entry);
-            publications.push_back(pub);
 
             for (const auto &author : pub.authors) {
-                authorPublicationMap[author].push_back(pub);
+                index[author].push_back(pub);
             }
         }
         file.close();
     }
 
+    // k-way merge of the per-file indexes into authorPublicationMap.
+    // Authors are visited in sorted order. Two entries are the same publication if
+    // their DOIs match, or if their normalized title and year match and their DOIs
+    // do not conflict. Repeats under one author are dropped, and a publication is
+    // counted as a duplicate once for every extra source file it appears in.
+    void mergeIndexes(std::vector<std::map<std::string, std::vector<Publication>>> &indexes) {
+        typedef std::map<std::string, std::vector<Publication>>::iterator IndexIter;
+        typedef std::pair<std::string, size_t> HeapItem; // (author, index number)
+
+        std::vector<IndexIter> cursors;
+        std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem>> heap;
+        for (size_t i = 0; i < indexes.size(); ++i) {
+            cursors.push_back(indexes[i].begin());
+            if (cursors[i] != indexes[i].end()) {
+                heap.push(HeapItem(cursors[i]->first, i));
+            }
+        }
+
+        // Global publication identities: id -> DOI and first source, plus lookups by DOI and title key
+        std::vector<std::string> idDoi;
+        std::vector<size_t> idSource;
+        std::map<std::string, size_t> idByDoi;
+        std::map<std::string, std::vector<size_t>> idsByTitle;
+        std::set<std::pair<size_t, size_t>> countedDuplicates; // (id, source)
+
+        auto resolve = [&](const Publication &pub, size_t source) -> size_t {
+            if (!pub.doi.empty()) {
+                auto found = idByDoi.find(pub.doi);
+                if (found != idByDoi.end()) {
+                    return found->second;
+                }
+            }
+            std::string key = publicationKey(pub);
+            std::vector<size_t> &candidates = idsByTitle[key];
+            for (size_t id : candidates) {
+                if (pub.doi.empty() || idDoi[id].empty()) {
+                    if (idDoi[id].empty() && !pub.doi.empty()) {
+                        idDoi[id] = pub.doi;
+                        idByDoi[pub.doi] = id;
+                    }
+                    return id;
+                }
+            }
+            size_t id = idDoi.size();
+            idDoi.push_back(pub.doi);
+            idSource.push_back(source);
+            candidates.push_back(id);
+            if (!pub.doi.empty()) {
+                idByDoi[pub.doi] = id;
+            }
+            publications.push_back(pub);
+            return id;
+        };
+
+        std::map<std::string, std::vector<Publication>> merged;
+        std::string currentAuthor;
+        std::set<size_t> seenForAuthor;
+        auto hint = merged.end();
+
+        while (!heap.empty()) {
+            HeapItem top = heap.top();
+            heap.pop();
+            size_t i = top.second;
+
+            if (hint == merged.end() || top.first != currentAuthor) {
+                currentAuthor = top.first;
+                seenForAuthor.clear();
+                hint = merged.insert(merged.end(), std::make_pair(currentAuthor, std::vector<Publication>()));
+            }
+
+            for (auto &pub : cursors[i]->second) {
+                size_t id = resolve(pub, i);
+                if (idSource[id] != i && countedDuplicates.insert(std::make_pair(id, i)).second) {
+                    ++duplicatePublications;
+                }
+                if (!seenForAuthor.insert(id).second) {
+                    continue;
+                }
+                hint->second.push_back(std::move(pub));
+            }
+
+            ++cursors[i];
+            if (cursors[i] != indexes[i].end()) {
+                heap.push(HeapItem(cursors[i]->first, i));
+            }
+        }
+
+        authorPublicationMap.swap(merged);
+    }
+
+public:
+    BibFileParser() : duplicatePublications(0) {}
+
+    void parse(const std::string &filename) {
+        parseFiles(std::vector<std::string>(1, filename));
+    }
+
+    // Parse several bib files concurrently, each into its own partial index,
+    // then combine them into authorPublicationMap
+    void parseFiles(const std::vector<std::string> &filenames) {
+        // Slot 0 is filled with anything parsed by earlier calls once all files parsed cleanly
+        std::vector<std::map<std::string, std::vector<Publication>>> indexes(filenames.size() + 1);
+
+        std::vector<std::exception_ptr> errors(filenames.size());
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            size_t i;
+            while ((i = next++) < filenames.size()) {
+                try {
+                    parseFileInto(filenames[i], indexes[i + 1]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+        threadCount = std::min(threadCount, filenames.size());
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; ++t) {
+            threads.push_back(std::thread(worker));
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        for (const auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        indexes[0].swap(authorPublicationMap);
+        publications.clear();
+        mergeIndexes(indexes);
+    }
+
+    size_t duplicateCount() const {
+        return duplicatePublications;
+    }
+
     void searchByAuthor(const std::string &authorName) const {
         // Normalize the search query to ensure it matches the stored format
         std::string normalizedQuery = normalizeAuthorName(authorName);
@@ -201,19 +367,119 @@ public:
     }
 };
 
+// Helper function to check if a path names a directory
+static bool isDirectory(const std::string &path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+// Helper function to check if a path names a regular file (symlinks are followed)
+static bool isRegularFile(const std::string &path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+}
+
+// Helper function to check if a path looks like a bib file (case-insensitive)
+static bool isBibPath(const std::string &path) {
+    const std::string ext = ".bib";
+    if (path.size() < ext.size()) {
+        return false;
+    }
+    for (size_t k = 0; k < ext.size(); ++k) {
+        if (std::tolower(static_cast<unsigned char>(path[path.size() - ext.size() + k])) != ext[k]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Collect all .bib regular files directly inside a directory, sorted so merge order is stable
+static std::vector<std::string> listBibFiles(const std::string &directory) {
+    std::vector<std::string> files;
+    DIR *dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        throw std::runtime_error("Could not open directory: " + directory);
+    }
+    while (struct dirent *ent = readdir(dir)) {
+        std::string name = ent->d_name;
+        std::string path = directory + "/" + name;
+        if (isBibPath(name) && isRegularFile(path)) {
+            files.push_back(path);
+        }
+    }
+    closedir(dir);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+static void printUsage(const char *program) {
+    std::cerr << "Usage: " << program << " <bib file or directory> [more bib files or directories...] [--] <author name> [additional author names...]\n";
+}
+
 int main(int argc, char *argv[]) {
-    if (argc < 3) {
-        std::cerr << "Usage: " << argv[0] << " <bib file path> <author name> [additional author names...]\n";
+    // Inputs come first, optionally ended by "--". Without "--", the first argument is always
+    // an input and later ones are inputs while they are existing files, directories or .bib paths.
+    int separator = 0;
+    for (int k = 1; k < argc; ++k) {
+        if (std::string(argv[k]) == "--") {
+            separator = k;
+            break;
+        }
+    }
+
+    std::vector<std::string> inputs;
+    int i = 1;
+    for (; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (separator != 0) {
+            if (i == separator) {
+                ++i;
+                break;
+            }
+        } else if (i > 1 && !isDirectory(arg) && !isRegularFile(arg) && !isBibPath(arg)) {
+            break;
+        }
+        inputs.push_back(arg);
+    }
+
+    if (inputs.empty() || i >= argc) {
+        printUsage(argv[0]);
         return 1;
     }
 
-    std::string bibFilePath = argv[1];
+    try {
+        std::vector<std::string> bibFiles;
+        for (const auto &input : inputs) {
+            if (isDirectory(input)) {
+                std::vector<std::string> dirFiles = listBibFiles(input);
+                bibFiles.insert(bibFiles.end(), dirFiles.begin(), dirFiles.end());
+            } else if (isRegularFile(input)) {
+                bibFiles.push_back(input);
+            } else {
+                std::cerr << "Not a readable bib file or directory: " << input << "\n";
+                return 1;
+            }
+        }
+
+        if (bibFiles.empty()) {
+            std::cerr << "No bib files found\n";
+            return 1;
+        }
+
+        BibFileParser parser;
+        parser.parseFiles(bibFiles);
 
-    BibFileParser parser;
-    parser.parse(bibFilePath);
+        if (parser.duplicateCount() > 0) {
+            std::cout << "Skipped " << parser.duplicateCount()
+                      << " publication(s) already read from another file\n";
+        }
 
-    for (int i = 2; i < argc; ++i) {
-        parser.searchByAuthor(argv[i]);
+        for (; i < argc; ++i) {
+            parser.searchByAuthor(argv[i]);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
     }
 
     return 0;